@@ -55,6 +55,9 @@
 
 #include <Components/PrimitiveComponent.h>		// 2) Engine files
 #include <Net/UnrealNetwork.h>
+#include <Async/ParallelFor.h>
+#include <Async/TaskGraphInterfaces.h>
+#include <UObject/UObjectGlobals.h>
 
 //#include <SDWidget.h>							// 3) SD Core files
 
@@ -209,6 +212,230 @@ void DontWasteMemory(const AActor& Actor)
 	//      don't intermingle bool's or small types willy nilly with bigger ones etc
 }
 
+namespace SDCodingStandardHelpers
+{
+	// [ue.parallel] long enough to amortize scheduling a batch, short enough to balance
+	constexpr static double TargetBatchSeconds = 50e-6;
+	// several batches per worker, so a worker that finishes early picks up more of the work
+	constexpr static int32 BatchesPerWorker = 4;
+	constexpr static int32 CostSampleCount = 8;
+	constexpr static double MinItemSeconds = 1e-8;
+	constexpr static double CostSmoothing = 0.25;
+
+	// [ue.parallel] caller owned, so the measured cost per item carries over between frames
+	struct FParallelCostEstimate
+	{
+		double ItemSeconds = 0.0; // 0 until the first pass measured it
+	};
+
+	// [ue.parallel] don't roll your own thread pool for per-frame component passes
+	//  ParallelFor hands the batches to the task graph workers, which grab the next one
+	//  as soon as they are free, so uneven work still balances out
+	//  - gather the components of all actors into one array and make one call per frame,
+	//    a call per actor pays the scheduling cost per actor for a handful of items
+	//  - the batch size is tuned from the cost per item measured on previous frames
+	//  - every batch owns its scratch container, on its own stack, so workers never share
+	//    allocations - pick an inline allocator as the policy (see [ue.alloc])
+	//  - the body runs off the game thread: read-only access, no UObject creation
+	template<class ScratchType, class ComponentType, class AllocatorType, class BodyType>
+	static void ParallelForEachComponent(const TArray<ComponentType*, AllocatorType>& Components,
+		FParallelCostEstimate& CostEstimate, const BodyType& Body)
+	{
+		const int32 Num = Components.Num();
+
+		// only the very first pass samples a few items serially for a starting estimate
+		int32 NumSamples = 0;
+		if (CostEstimate.ItemSeconds <= 0.0)
+		{
+			NumSamples = FMath::Min(Num, CostSampleCount);
+
+			ScratchType SampleScratch;
+			const double StartSeconds = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumSamples; ++Index)
+			{
+				SampleScratch.Reset();
+				Body(*Components[Index], SampleScratch);
+			}
+			if (NumSamples > 0)
+			{
+				CostEstimate.ItemSeconds = FMath::Max(
+					(FPlatformTime::Seconds() - StartSeconds) / NumSamples, MinItemSeconds);
+			}
+		}
+
+		const int32 NumRemaining = Num - NumSamples;
+		if (NumRemaining <= 0)
+		{
+			return;
+		}
+
+		const int32 NumWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		const int32 MaxBatchSize =
+			FMath::Max(NumRemaining / (NumWorkers * BatchesPerWorker), 1);
+		const double IdealBatchSize = TargetBatchSeconds / CostEstimate.ItemSeconds;
+		const int32 BatchSize =
+			static_cast<int32>(FMath::Clamp<double>(IdealBatchSize, 1.0, MaxBatchSize));
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumRemaining, BatchSize);
+
+		// keep measuring, so the estimate follows the cost as the content changes
+		std::atomic<uint64> BusyCycles{0};
+
+		// Unbalanced makes ParallelFor hand out our batches one at a time instead of grouping
+		//  them into blocks of its own, so BatchSize stays the only level of batching
+		//  NOTE: on engine versions with a MinBatchSize argument, pass BatchSize there instead
+		ParallelFor(NumBatches,
+			[&Components, &Body, &BusyCycles, Num, NumSamples, BatchSize](int32 BatchIndex)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			ScratchType Scratch;
+			const int32 Begin = NumSamples + BatchIndex * BatchSize;
+			const int32 End = FMath::Min(Begin + BatchSize, Num);
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Scratch.Reset(); // [ue.container.reset]
+				Body(*Components[Index], Scratch);
+			}
+
+			BusyCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles,
+				std::memory_order_relaxed);
+		}, EParallelForFlags::Unbalanced);
+
+		const double MeasuredItemSeconds = FMath::Max(
+			FPlatformTime::ToSeconds64(BusyCycles.load()) / NumRemaining, MinItemSeconds);
+		CostEstimate.ItemSeconds =
+			FMath::Lerp(CostEstimate.ItemSeconds, MeasuredItemSeconds, CostSmoothing);
+	}
+}
+
+// [ue.parallel] one flat array and one call per frame, not one call per actor
+void ProcessComponentsInParallel(const TArray<const AActor*>& Actors,
+	SDCodingStandardHelpers::FParallelCostEstimate& CostEstimate)
+{
+	TArray<UPrimitiveComponent*> PrimComponents;
+	PrimComponents.Reserve(Actors.Num() * 4); // [ue.container.reserve]
+
+	TInlineComponentArray<UPrimitiveComponent*> ActorComponents;
+	for (const AActor* Actor : Actors)
+	{
+		Actor->GetComponents(ActorComponents);
+		PrimComponents.Append(ActorComponents);
+	}
+
+	using FCornerScratch = TArray<FVector, TInlineAllocator<8>>;
+	SDCodingStandardHelpers::ParallelForEachComponent<FCornerScratch>(PrimComponents,
+		CostEstimate, [](const UPrimitiveComponent& Component, FCornerScratch& Corners)
+	{
+		const FBox Box = Component.Bounds.GetBox();
+		Corners.Add(Box.Min);
+		Corners.Add(Box.Max);
+		// ...
+	});
+}
+
+float USDCodingStandardBlueprintLibrary::GetHalfTraceWidth(
+	const FSDCodingStandardBlueprintVarGroup& Vars)
+{
+	return DoPassBlueprintVarStructs(Vars);
+}
+
+// [ue.bp.pure] the pure version re-gathers the whole array for every pin that reads it
+TArray<UPrimitiveComponent*> USDCodingStandardBlueprintLibrary::GetPrimitiveComponents(
+	const AActor* Actor)
+{
+	TArray<UPrimitiveComponent*> Components;
+	GatherPrimitiveComponents(Actor, Components);
+	return Components;
+}
+
+void USDCodingStandardBlueprintLibrary::GatherPrimitiveComponents(const AActor* Actor,
+	TArray<UPrimitiveComponent*>& OutComponents)
+{
+	OutComponents.Reset();
+	if (Actor)
+	{
+		Actor->GetComponents(OutComponents);
+	}
+}
+
+// [singleton.alt] the only shared state is the index counter, never the services themselves
+int32 FSDCodingStandardServiceScope::AllocateServiceIndex()
+{
+	static std::atomic<int32> NextIndex{0};
+	const int32 Index = NextIndex.fetch_add(1, std::memory_order_relaxed);
+
+	// not check(), it's compiled out in Shipping and the next store would be out of bounds
+	if (Index >= MaxServices)
+	{
+		UE_LOG(LogTemp, Fatal, TEXT("More than %d service types, raise MaxServices"),
+			MaxServices);
+	}
+	return Index;
+}
+
+FSDCodingStandardServiceScopeHolder::~FSDCodingStandardServiceScopeHolder()
+{
+	delete Scope.load(std::memory_order_acquire);
+}
+
+TUniquePtr<FSDCodingStandardServiceScope> FSDCodingStandardServiceScopeHolder::Swap(
+	TUniquePtr<FSDCodingStandardServiceScope> NewScope)
+{
+	FSDCodingStandardServiceScope* const RetiredScope =
+		Scope.exchange(NewScope.Release(), std::memory_order_acq_rel);
+	return TUniquePtr<FSDCodingStandardServiceScope>(RetiredScope);
+}
+
+// [singleton.alt] a plain C++ service, not a UObject
+class FSDCodingStandardExampleService
+{
+public:
+	int32 GetValue() const { return Value; }
+
+private:
+	int32 Value = 42;
+};
+
+void UseServiceScope(FSDCodingStandardServiceScopeHolder& Holder)
+{
+	// readers: any thread, but the service is only used inside the task that fetched it
+	FGraphEventArray ReaderTasks;
+	const auto LaunchReader = [&Holder, &ReaderTasks]()
+	{
+		ReaderTasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([&Holder]()
+		{
+			const FSDCodingStandardServiceScope* Scope = Holder.Get();
+			const FSDCodingStandardExampleService* Found =
+				Scope ? Scope->Get<const FSDCodingStandardExampleService>() : nullptr;
+			if (Found)
+			{
+				const int32 Value = Found->GetValue();
+				// ...
+			}
+		}));
+	};
+
+	// setup or Hot Reload: build and fill the scope first, then publish it
+	TUniquePtr<FSDCodingStandardExampleService> Service =
+		MakeUnique<FSDCodingStandardExampleService>();
+	TUniquePtr<FSDCodingStandardServiceScope> NewScope =
+		MakeUnique<FSDCodingStandardServiceScope>();
+	NewScope->Register(*Service);
+
+	// only the owner swaps, so the scope published here stays alive until its next Swap
+	FSDCodingStandardServiceScope* const PublishedScope = NewScope.Get();
+	LaunchReader(); // in flight across the Swap, may still be using the retired scope
+	TUniquePtr<FSDCodingStandardServiceScope> RetiredScope = Holder.Swap(MoveTemp(NewScope));
+	LaunchReader();
+
+	// teardown: unpublish from the scope this code published, wait for every reader that
+	//  could have fetched the service or the retired scope, only then destroy them
+	PublishedScope->Unregister<FSDCodingStandardExampleService>();
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(ReaderTasks);
+	Service.Reset();
+	RetiredScope.Reset();
+}
+
 // [markup.engine] Use special markers for engine changes
 void EngineChanges()
 {
@@ -391,6 +618,45 @@ void SDCodingStandardHelpers::PublicHelper(const USDCodingStandardExampleCompone
 {
 }
 
+// [ue.ecs.gc.cache] [globals.no] POD globals, which is fine
+uint32 SDCodingStandardHelpers::GarbageCollectionEpoch = 0;
+
+namespace SDCodingStandardHelpers
+{
+	// keeps counting across unbind/bind, so a value cached before Unbind never matches again
+	static uint32 GarbageCollectionCount = 0;
+	static FDelegateHandle GarbageCollectionHandle;
+
+	static void AdvanceGarbageCollectionEpoch()
+	{
+		// skip 0 on wrap around, it's reserved for "not bound"
+		if (++GarbageCollectionCount == 0)
+		{
+			++GarbageCollectionCount;
+		}
+		GarbageCollectionEpoch = GarbageCollectionCount;
+	}
+}
+
+void SDCodingStandardHelpers::BindGarbageCollectionEpoch()
+{
+	if (GarbageCollectionHandle.IsValid())
+	{
+		return;
+	}
+
+	AdvanceGarbageCollectionEpoch();
+	GarbageCollectionHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(
+		&AdvanceGarbageCollectionEpoch);
+}
+
+void SDCodingStandardHelpers::UnbindGarbageCollectionEpoch()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(GarbageCollectionHandle);
+	GarbageCollectionHandle.Reset();
+	GarbageCollectionEpoch = 0;
+}
+
 // [func.default.args] put in a C-style comment any default argument
 void CreateSequence(int32 Start, int32 End, int32 Increment /* = 1 */)
 {
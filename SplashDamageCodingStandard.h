@@ -54,6 +54,10 @@
 #include <GameFramework/HUD.h>
 #include <GameFramework/HUDHitBox.h>
 
+#include <Kismet/BlueprintFunctionLibrary.h>
+
+#include <atomic>
+
 // [header.incl.order]
 //  Generally speaking the include order of files should be:
 //  1) CoreMinimal
@@ -75,6 +79,7 @@
 class UInputComponent;
 class UCameraComponent;
 class USkeletalMeshComponent;
+class UPrimitiveComponent;
 
 UCLASS()
 // [class.name] embed the agreed project codename while following UE4 naming rules. 
@@ -130,6 +135,7 @@ protected:
 	// [ue.ecs.gc] never use naked pointers to UObject's, always have UPROPERTY or UE smart ptr
 	//  Generally, for storing pointers to classes you don't own, use TWeakObjectPtr.
 	TWeakObjectPtr<const USkeletalMeshComponent> OtherMesh = nullptr;
+	//  On hot read paths, where Get() is called over and over, see [ue.ecs.gc.cache]
 	//  Generally, for storing pointers to classes you do own, use UPROPERTY().
 	UPROPERTY(BlueprintReadOnly, Category = Mesh)
 	const USkeletalMeshComponent* MyMesh = nullptr;
@@ -200,6 +206,103 @@ enum class ESDCodingStandardEnum // `: uint8` optional underlying type
 };
 ENUM_RANGE_BY_COUNT(ESDCodingStandardEnum, ESDCodingStandardEnum::Count);
 
+// [func.arg.strong] strong typedefs take [func.arg.readability] one step further
+//  a plain `using` only documents intent, a strong type makes the compiler reject swapped
+//  arguments and stops a raw `42` or `false` from converting silently
+//  - passing them is free: a wrapper around a single value with the same size and trivial
+//    copy/destruction is passed as an argument in registers just like the raw value
+//    (every instantiation checks this in its constructor)
+//  - returning them is not always free: on Win64 MSVC a type with a user-provided constructor
+//    is returned through a hidden pointer instead of RAX, so a non-inlined function returning
+//    one (arithmetic operators included) costs a store and a load more than the raw version
+//  - opt in only to the operations that make sense - an order can be compared, not added
+enum class ESDStrongTypeSkills : uint8
+{
+	None = 0,
+	Compare = 1 << 0,
+	Arithmetic = 1 << 1,
+	Hash = 1 << 2,
+};
+ENUM_CLASS_FLAGS(ESDStrongTypeSkills);
+
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills = ESDStrongTypeSkills::None>
+struct TSDStrongType
+{
+	constexpr explicit TSDStrongType(ValueType InValue);
+	constexpr ValueType Get() const { return Value; }
+
+private:
+	ValueType Value;
+};
+
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+constexpr TSDStrongType<ValueType, TagType, Skills>::TSDStrongType(ValueType InValue)
+	: Value(InValue)
+{
+	//  if any of these fail, the wrapper is no longer free - fix it, don't remove the check
+	static_assert(sizeof(TSDStrongType) == sizeof(ValueType),
+		"Strong types must not add padding");
+	static_assert(alignof(TSDStrongType) == alignof(ValueType),
+		"Strong types must keep the alignment");
+	static_assert(TIsTriviallyCopyConstructible<TSDStrongType>::Value
+		&& TIsTriviallyDestructible<TSDStrongType>::Value,
+		"Strong types must stay trivially copyable to be passed in registers");
+}
+
+// [cpp.rel_ops] free form operators, only enabled for the types that opted in
+//  NOTE: strong types are passed by value, they are as cheap as the value they wrap
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+constexpr typename TEnableIf<EnumHasAnyFlags(Skills, ESDStrongTypeSkills::Compare), bool>::Type
+operator == (
+	TSDStrongType<ValueType, TagType, Skills> lhs,
+	TSDStrongType<ValueType, TagType, Skills> rhs)
+{
+	return lhs.Get() == rhs.Get();
+}
+
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+constexpr typename TEnableIf<EnumHasAnyFlags(Skills, ESDStrongTypeSkills::Compare), bool>::Type
+operator < (
+	TSDStrongType<ValueType, TagType, Skills> lhs,
+	TSDStrongType<ValueType, TagType, Skills> rhs)
+{
+	return lhs.Get() < rhs.Get();
+}
+
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+constexpr typename TEnableIf<EnumHasAnyFlags(Skills, ESDStrongTypeSkills::Arithmetic),
+	TSDStrongType<ValueType, TagType, Skills>>::Type
+operator + (
+	TSDStrongType<ValueType, TagType, Skills> lhs,
+	TSDStrongType<ValueType, TagType, Skills> rhs)
+{
+	return TSDStrongType<ValueType, TagType, Skills>(lhs.Get() + rhs.Get());
+}
+
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+constexpr typename TEnableIf<EnumHasAnyFlags(Skills, ESDStrongTypeSkills::Arithmetic),
+	TSDStrongType<ValueType, TagType, Skills>>::Type
+operator - (
+	TSDStrongType<ValueType, TagType, Skills> lhs,
+	TSDStrongType<ValueType, TagType, Skills> rhs)
+{
+	return TSDStrongType<ValueType, TagType, Skills>(lhs.Get() - rhs.Get());
+}
+
+// [func.arg.strong] enables TMap/TSet keys, which also need `==`, so Hash requires Compare
+template<class ValueType, class TagType, ESDStrongTypeSkills Skills>
+typename TEnableIf<EnumHasAllFlags(Skills,
+	ESDStrongTypeSkills::Hash | ESDStrongTypeSkills::Compare), uint32>::Type
+GetTypeHash(TSDStrongType<ValueType, TagType, Skills> Key)
+{
+	return GetTypeHash(Key.Get());
+}
+
+// [func.arg.strong] an empty tag per type, it's what makes two `int32` wrappers distinct
+using FSDOrder = TSDStrongType<int32, struct FSDOrderTag,
+	ESDStrongTypeSkills::Compare | ESDStrongTypeSkills::Hash>;
+using FSDLoadOnPlay = TSDStrongType<bool, struct FSDLoadOnPlayTag>;
+
 UCLASS()
 class USDCodingStandardExampleComponent : public USceneComponent
 {
@@ -215,6 +318,8 @@ public:
 	//  argument names in declarations are ignored, try to encode as much meaning as possible in the
 	//  type also even this simple typedef/using goes a long way readability wise at the call site:
 	//  ex: FuncNiceToReadOnCall(FOrder(42), FCacheFlags::Use, FLogFlags::Custom, FLoadOnPlay(false));
+	/* BETTER -> */ void FuncStrongTypedOnCall(FSDOrder, ECacheFlags, FSDLoadOnPlay) const;
+	//  see [func.arg.strong], FuncStrongTypedOnCall(42, ...) will not compile
 
 	// [func.arg.readability] avoid consecutive chains of same type, avoid too many arguments
 	/* BAD -> */ void FuncWithTooManyArgs(const FVector& Location, const FVector& Origin,
@@ -228,6 +333,7 @@ public:
 	//  - discuss alternatives with your lead
 	//  - if you somehow have to add one, first reconsider
 	//    - then use the Meyers pattern: https://stackoverflow.com/a/1661564
+	//  - prefer a scoped registry instead, see [singleton.alt]
 	/* BAD -> */ static USDCodingStandardExampleComponent* Instance; // defined in .cpp
 	/* VERY BAD -> */ const USDCodingStandardExampleComponent* GetInstance() const { return Instance; }
 
@@ -265,6 +371,121 @@ private:
 	bool bInGame, bCanAttack, bUseLog, bHasCustomStencil; /* <- GOOD */
 };
 
+// [ue.bp.pure] mind the cost of BlueprintPure functions
+//  a pure node has no execution pin, so the Blueprint VM evaluates it again for every
+//  input pin that reads one of its outputs - inside a ForEach body that means once per pin
+//  per iteration, not once per loop
+//  - keep pure functions cheap and without side effects: getters, simple math
+//  - anything that iterates, allocates or traces should be BlueprintCallable so it runs
+//    once and its result can be cached in a local variable by the caller
+//  - `const` UFUNCTIONs are implicitly pure! use `BlueprintPure = false` to opt out
+//  see BlueprintStandards/Content/BPL_Standard_04_BlueprintFunctionLibraries for the Blueprint side
+UCLASS()
+class USDCodingStandardBlueprintLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category = Camera)
+	static float GetHalfTraceWidth(const FSDCodingStandardBlueprintVarGroup& Vars); /* <- GOOD */
+
+	UFUNCTION(BlueprintPure, Category = Components)
+	static TArray<UPrimitiveComponent*> GetPrimitiveComponents(const AActor* Actor); /* <- BAD */
+
+	UFUNCTION(BlueprintCallable, Category = Components)
+	static void GatherPrimitiveComponents(const AActor* Actor,
+		TArray<UPrimitiveComponent*>& OutComponents); /* <- GOOD */
+};
+
+// [singleton.alt] prefer a scoped service registry to singletons and hashed lookups
+//  - the scope is owned by something with a clear lifetime (GameInstance, World, subsystem)
+//  - each service type gets a dense index on first use, so a lookup is a guarded static read
+//    plus one acquire load instead of a TMap<UClass*, UObject*> search on a hot path
+//  - plain C++ services only! the GC can't see the registry, so never register UObjects
+//    (see [ue.ecs.gc]) - UObject services stay UPROPERTYs and are used on the game thread
+//  - Register publishes with release, Get reads with acquire semantics: a service that was
+//    fully built before Register is safe to read from any thread
+//  - that does NOT make teardown safe, a reader can load the pointer just before Unregister
+//    - readers only use a service inside the task that fetched it, they never store it
+//    - the owner calls Unregister, waits for every reader task that could have fetched the
+//      pointer to complete and only then destroys the service
+//  - the scope does NOT own the services, the owner keeps them alive
+//  - on Hot Reload build a new scope and publish it with FSDCodingStandardServiceScopeHolder
+//    the retired scope follows the same teardown sequence as a service
+//  NOTE: indices are allocated per module, keep the services and their scope in one module
+class FSDCodingStandardServiceScope
+{
+public:
+	template<class ServiceType>
+	ServiceType* Get() const;
+
+	template<class ServiceType>
+	void Register(ServiceType& Service);
+
+	template<class ServiceType>
+	void Unregister();
+
+private:
+	template<class ServiceType>
+	static int32 GetServiceIndex();
+	static int32 AllocateServiceIndex(); // defined in .cpp
+
+	constexpr static int32 MaxServices = 64;
+	std::atomic<void*> Services[MaxServices] = {};
+};
+
+// [singleton.alt] the one place readers go to find the current scope
+//  Swap publishes a fully built scope and hands back the retired one
+//  destroy the retired scope only after the reader tasks that could still see it completed
+class FSDCodingStandardServiceScopeHolder
+{
+public:
+	~FSDCodingStandardServiceScopeHolder(); // readers must be done, like for Swap
+
+	FSDCodingStandardServiceScope* Get() const { return Scope.load(std::memory_order_acquire); }
+
+	TUniquePtr<FSDCodingStandardServiceScope> Swap(
+		TUniquePtr<FSDCodingStandardServiceScope> NewScope);
+
+private:
+	std::atomic<FSDCodingStandardServiceScope*> Scope{nullptr};
+};
+
+template<class ServiceType>
+ServiceType* FSDCodingStandardServiceScope::Get() const
+{
+	const int32 Index = GetServiceIndex<typename TRemoveCV<ServiceType>::Type>();
+	return static_cast<ServiceType*>(Services[Index].load(std::memory_order_acquire));
+}
+
+template<class ServiceType>
+void FSDCodingStandardServiceScope::Register(ServiceType& Service)
+{
+	static_assert(TAreTypesEqual<ServiceType, typename TRemoveCV<ServiceType>::Type>::Value,
+		"Register through a non-const reference, Get<const ServiceType>() still finds it");
+
+	const int32 Index = GetServiceIndex<typename TRemoveCV<ServiceType>::Type>();
+	Services[Index].store(&Service, std::memory_order_release);
+}
+
+template<class ServiceType>
+void FSDCodingStandardServiceScope::Unregister()
+{
+	const int32 Index = GetServiceIndex<typename TRemoveCV<ServiceType>::Type>();
+	Services[Index].store(nullptr, std::memory_order_release);
+}
+
+template<class ServiceType>
+int32 FSDCodingStandardServiceScope::GetServiceIndex()
+{
+	static_assert(!TIsDerivedFrom<ServiceType, UObject>::IsDerived,
+		"The GC can't see the service registry, see [singleton.alt]");
+
+	// [singleton.alt] the Meyers pattern is fine here: it only caches an integer
+	static const int32 Index = AllocateServiceIndex();
+	return Index;
+}
+
 // [class.inline.good]
 //  - don't use FORCEINLINE unless you really want to persuade the
 //      compiler to inline a complicated function
@@ -295,6 +516,64 @@ inline bool operator == (
 namespace SDCodingStandardHelpers
 {
 	void PublicHelper(const USDCodingStandardExampleComponent& Object);
+
+	// [ue.ecs.gc.cache] bumped after every garbage collection, 0 while nothing is bound
+	//  pair BindGarbageCollectionEpoch in StartupModule with UnbindGarbageCollectionEpoch
+	//  in ShutdownModule, so the GC delegate never outlives the module
+	//  NOTE: not exported, keep the TSDCachedWeakObjectPtr users in the module defining it
+	extern uint32 GarbageCollectionEpoch;
+	void BindGarbageCollectionEpoch();
+	void UnbindGarbageCollectionEpoch();
+}
+
+// [ue.ecs.gc.cache] TWeakObjectPtr::Get() checks the object index and serial number every call
+//  on hot read paths cache the resolved pointer and only re-validate after a GC has run
+//  - UObjects are only freed by the GC, so a pointer resolved since the last GC never dangles
+//  - BUT objects marked pending kill since then are still returned, check IsValid() if it matters
+//  - while the epoch isn't bound it falls back to TWeakObjectPtr::Get() on every call
+//  - game thread only, just like the garbage collection it keeps track of
+template<class ObjectType>
+class TSDCachedWeakObjectPtr
+{
+public:
+	TSDCachedWeakObjectPtr() = default;
+	TSDCachedWeakObjectPtr(ObjectType* Object) : WeakObject(Object) {}
+
+	TSDCachedWeakObjectPtr& operator = (ObjectType* Object);
+
+	ObjectType* Get() const;
+
+private:
+	TWeakObjectPtr<ObjectType> WeakObject;
+	mutable ObjectType* CachedObject = nullptr;
+	mutable uint32 CachedEpoch = 0; // never a bound epoch, forces the first Get() to resolve
+};
+
+template<class ObjectType>
+TSDCachedWeakObjectPtr<ObjectType>& TSDCachedWeakObjectPtr<ObjectType>::operator = (
+	ObjectType* Object)
+{
+	WeakObject = Object;
+	CachedEpoch = 0;
+	return *this;
+}
+
+template<class ObjectType>
+ObjectType* TSDCachedWeakObjectPtr<ObjectType>::Get() const
+{
+	const uint32 Epoch = SDCodingStandardHelpers::GarbageCollectionEpoch;
+	if (Epoch == 0)
+	{
+		// nothing tracks the GC, so the cache can't be trusted
+		return WeakObject.Get();
+	}
+
+	if (CachedEpoch != Epoch)
+	{
+		CachedObject = WeakObject.Get();
+		CachedEpoch = Epoch;
+	}
+	return CachedObject;
 }
 
 // [module.naming] when adding new module folders follow a consistent naming convention